@@ -7,7 +7,11 @@ enum EventType {
     VEHICLE_SPAWN,
     VEHICLE_ARRIVAL,
     LIGHT_CHANGE,
-    PATH_RECALCULATION
+    PATH_RECALCULATION,
+    EMERGENCY_DISPATCH,
+    ROAD_CLOSURE,
+    ROAD_REOPEN,
+    CAPACITY_CHANGE
 };
 
 struct Event {
@@ -15,6 +19,7 @@ struct Event {
     EventType type;
     int entityID; // Can be Vehicle ID or Intersection ID depending on type
     int secondaryID; // Optional, e.g., Road ID or Destination ID
+    double value; // Optional payload, e.g., new road capacity
 
     // Priority Queue needs to order by smallest timestamp first (Min-Heap)
     bool operator>(const Event& other) const {
@@ -0,0 +1,51 @@
+#include "IncidentFeed.h"
+#include <fstream>
+#include <sstream>
+#include <limits>
+#include <thread>
+
+bool parseFeedLine(const std::string& line, Event& event) {
+    std::istringstream in(line);
+    std::string kind;
+    if (!(in >> event.timestamp >> kind)) return false;
+
+    event.entityID = -1;
+    event.secondaryID = -1;
+    event.value = 0.0;
+
+    if (kind == "SPAWN" || kind == "DISPATCH") {
+        event.type = (kind == "SPAWN") ? VEHICLE_SPAWN : EMERGENCY_DISPATCH;
+        return (bool)(in >> event.entityID >> event.secondaryID);
+    }
+    if (kind == "CLOSE" || kind == "REOPEN") {
+        event.type = (kind == "CLOSE") ? ROAD_CLOSURE : ROAD_REOPEN;
+        return (bool)(in >> event.entityID);
+    }
+    if (kind == "CAPACITY") {
+        event.type = CAPACITY_CHANGE;
+        if (!(in >> event.entityID >> event.value)) return false;
+        // Same bounds processEvent enforces; NaN fails both comparisons
+        return event.value >= 1.0 && event.value <= std::numeric_limits<int>::max();
+    }
+    return false;
+}
+
+int replayIncidentFeed(const std::string& filename, TrafficNetwork& network) {
+    std::ifstream file(filename);
+    if (!file) return -1;
+
+    int injected = 0;
+    std::string line;
+    while (std::getline(file, line)) {
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) line.erase(comment);
+
+        Event event;
+        if (parseFeedLine(line, event)) {
+            // Queue full: back off on this (producer) thread until the tick loop drains it
+            while (!network.injectEvent(event)) std::this_thread::yield();
+            injected++;
+        }
+    }
+    return injected;
+}
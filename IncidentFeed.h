@@ -0,0 +1,24 @@
+#ifndef INCIDENTFEED_H
+#define INCIDENTFEED_H
+
+#include <string>
+#include "TrafficNetwork.h"
+
+// Stand-in for a live city feed: reads timestamped events from a text file
+// and injects them into a running network from the calling thread.
+// If the ingestion queue is full, the calling thread (not the simulation) waits.
+//
+// One event per line, '#' starts a comment:
+//   <time> SPAWN <startNode> <destNode>
+//   <time> DISPATCH <startNode> <destNode>   (emergency vehicle)
+//   <time> CLOSE <roadID>
+//   <time> REOPEN <roadID>
+//   <time> CAPACITY <roadID> <newCapacity>
+//
+// Returns the number of events injected, or -1 if the file can't be opened.
+int replayIncidentFeed(const std::string& filename, TrafficNetwork& network);
+
+// Parses one feed line. Returns false for blank, comment or malformed lines.
+bool parseFeedLine(const std::string& line, Event& event);
+
+#endif // INCIDENTFEED_H
@@ -0,0 +1,77 @@
+#ifndef MPSCQUEUE_H
+#define MPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// Bounded lock-free multi-producer, single-consumer queue (Vyukov ring).
+// Any number of threads may tryPush(); only one thread may pop().
+// All cells are allocated up front, so neither side touches the heap after
+// construction and the consumer can never be stalled by an allocator lock.
+// Producers claim a cell with a CAS; pop() never waits.
+template <typename T>
+class MPSCQueue {
+public:
+    // Capacity is rounded up to a power of two
+    MPSCQueue(size_t capacity = 1024) : enqueuePos(0), dequeuePos(0) {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        cells = std::vector<Cell>(size);
+        mask = size - 1;
+        for (size_t i = 0; i < size; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MPSCQueue(const MPSCQueue&) = delete;
+    MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+    // Safe to call from any thread. Returns false if the queue is full.
+    bool tryPush(const T& value) {
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells[pos & mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            long long diff = (long long)seq - (long long)pos;
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false; // Full: the consumer hasn't freed this cell yet
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = value;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer thread only. Returns false if nothing is ready.
+    bool pop(T& out) {
+        Cell* cell = &cells[dequeuePos & mask];
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+        if ((long long)seq - (long long)(dequeuePos + 1) < 0) return false;
+
+        out = cell->value;
+        cell->sequence.store(dequeuePos + mask + 1, std::memory_order_release); // Free for the next lap
+        dequeuePos++;
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+
+        Cell() : sequence(0), value() {}
+    };
+
+    std::vector<Cell> cells;
+    size_t mask;
+    std::atomic<size_t> enqueuePos; // Shared by producers
+    size_t dequeuePos;              // Consumer only
+};
+
+#endif // MPSCQUEUE_H
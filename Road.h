@@ -4,6 +4,7 @@
 #include <cmath>
 #include <deque>
 #include "Vehicle.h"
+#include "TravelTimeProfile.h"
 
 struct Road {
     int id;
@@ -11,16 +12,18 @@ struct Road {
     int destinationID;
     double baseDistance;
     double speedLimit;
-    int currentVehicleCount;
+    int currentVehicleCount; // Vehicles currently in vehicleQueue
     int capacity; // To calculate congestion factor
+    bool closed; // Closed roads are skipped by routing and can't be entered
     std::deque<Vehicle*> vehicleQueue; // Queue of vehicles on this road
+    TravelTimeProfile travelTimeProfile; // Observed traversal times by entry time
 
     double getQueueLength() const {
         return vehicleQueue.size();
     }
 
     Road(int id, int src, int dest, double dist, double speed, int cap = 10)
-        : id(id), sourceID(src), destinationID(dest), baseDistance(dist), speedLimit(speed), currentVehicleCount(0), capacity(cap) {}
+        : id(id), sourceID(src), destinationID(dest), baseDistance(dist), speedLimit(speed), currentVehicleCount(0), capacity(cap), closed(false) {}
 
     double getCongestionFactor() const {
         if (capacity == 0) return 0.0;
@@ -29,11 +32,26 @@ struct Road {
     }
 
     double getDynamicWeight() const {
+        if (closed) return INFINITY;
         double congestion = getCongestionFactor();
         // Weight = Distance / (Speed * (1 - Congestion))
         // If congestion is high, effective speed drops, weight increases.
         return baseDistance / (speedLimit * (1.0 - congestion));
     }
+
+    // Physical travel-time estimate in the same units as observed traversals:
+    // cruise-speed time, stretched by current congestion
+    double getEstimatedTravelTime() const {
+        if (closed) return INFINITY;
+        return (baseDistance / VEHICLE_SPEED) / (1.0 - getCongestionFactor());
+    }
+
+    // Expected traversal time for a vehicle entering at `entryTime`.
+    // Uses the learned profile where available, the physical estimate otherwise.
+    double getPredictedTravelTime(double entryTime) const {
+        if (closed) return INFINITY;
+        return travelTimeProfile.travelTime(entryTime, getEstimatedTravelTime());
+    }
 };
 
 #endif // ROAD_H
@@ -0,0 +1,55 @@
+#include "RouteCache.h"
+#include <cmath>
+
+RouteCache::RouteCache(size_t capacity, double bucketWidth, double maxAge)
+    : capacity(capacity), bucketWidth(bucketWidth), maxAge(maxAge), hits(0), misses(0) {}
+
+RouteCache::Key RouteCache::makeKey(int startNode, int destNode, double departureTime) const {
+    return {startNode, destNode, (long long)std::floor(departureTime / bucketWidth)};
+}
+
+bool RouteCache::lookup(int startNode, int destNode, double departureTime, double now, std::vector<int>& path) {
+    auto it = index.find(makeKey(startNode, destNode, departureTime));
+    if (it == index.end()) {
+        misses++;
+        return false;
+    }
+
+    // Stale: computed from older profile data
+    if (now - it->second->computedAt > maxAge) {
+        entries.erase(it->second);
+        index.erase(it);
+        misses++;
+        return false;
+    }
+
+    entries.splice(entries.begin(), entries, it->second);
+    path = it->second->path;
+    hits++;
+    return true;
+}
+
+void RouteCache::insert(int startNode, int destNode, double departureTime, double now, const std::vector<int>& path) {
+    if (capacity == 0) return;
+    Key key = makeKey(startNode, destNode, departureTime);
+
+    auto it = index.find(key);
+    if (it != index.end()) {
+        it->second->path = path;
+        it->second->computedAt = now;
+        entries.splice(entries.begin(), entries, it->second);
+        return;
+    }
+
+    if (entries.size() >= capacity) {
+        index.erase(entries.back().key);
+        entries.pop_back();
+    }
+    entries.push_front({key, path, now});
+    index[key] = entries.begin();
+}
+
+void RouteCache::clear() {
+    entries.clear();
+    index.clear();
+}
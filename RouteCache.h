@@ -0,0 +1,62 @@
+#ifndef ROUTECACHE_H
+#define ROUTECACHE_H
+
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+// LRU cache of recent origin-destination routes, keyed by departure-time bucket.
+// Entries expire after `maxAge` simulated seconds so routes follow the
+// travel-time profiles as they are learned.
+class RouteCache {
+public:
+    RouteCache(size_t capacity = 1024, double bucketWidth = 30.0, double maxAge = 30.0);
+
+    // Returns true and fills `path` on a fresh hit
+    bool lookup(int startNode, int destNode, double departureTime, double now, std::vector<int>& path);
+    void insert(int startNode, int destNode, double departureTime, double now, const std::vector<int>& path);
+    void clear();
+
+    size_t getHits() const { return hits; }
+    size_t getMisses() const { return misses; }
+
+private:
+    struct Key {
+        int startNode;
+        int destNode;
+        long long bucket;
+
+        bool operator==(const Key& other) const {
+            return startNode == other.startNode && destNode == other.destNode && bucket == other.bucket;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& k) const {
+            size_t h = std::hash<int>()(k.startNode);
+            h = h * 31 + std::hash<int>()(k.destNode);
+            h = h * 31 + std::hash<long long>()(k.bucket);
+            return h;
+        }
+    };
+
+    struct Entry {
+        Key key;
+        std::vector<int> path;
+        double computedAt;
+    };
+
+    size_t capacity;
+    double bucketWidth;
+    double maxAge;
+    size_t hits;
+    size_t misses;
+
+    std::list<Entry> entries; // Most recently used at the front
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+
+    Key makeKey(int startNode, int destNode, double departureTime) const;
+};
+
+#endif // ROUTECACHE_H
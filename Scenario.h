@@ -0,0 +1,56 @@
+#ifndef SCENARIO_H
+#define SCENARIO_H
+
+#include <vector>
+#include "TrafficNetwork.h"
+
+// A reproducible snapshot of a road network plus its travel demand.
+// Every candidate signal plan is evaluated on a fresh network built from
+// the same scenario, so results are directly comparable.
+struct Scenario {
+    struct NodeSpec {
+        int id;
+        double x, y;
+    };
+
+    struct RoadSpec {
+        int id;
+        int source;
+        int dest;
+        double length;
+        double speedLimit;
+    };
+
+    struct TripSpec {
+        int vehicleID;
+        int startNode;
+        int destNode;
+        bool isEmergency;
+        double spawnTime;
+    };
+
+    std::vector<NodeSpec> nodes;
+    std::vector<RoadSpec> roads;
+    std::vector<TripSpec> demand;
+    double duration;
+    unsigned int seed; // Seeds vehicle recycling so every run sees the same follow-up trips
+
+    Scenario() : duration(600.0), seed(5489u) {}
+
+    void buildNetwork(TrafficNetwork& network) const {
+        buildGraph(network);
+        addDemand(network);
+    }
+
+    void buildGraph(TrafficNetwork& network) const {
+        for (const NodeSpec& n : nodes) network.addIntersection(n.id, n.x, n.y);
+        for (const RoadSpec& r : roads) network.addRoad(r.id, r.source, r.dest, r.length, r.speedLimit);
+    }
+
+    // Initial routes are planned here, so load travel-time profiles before calling this
+    void addDemand(TrafficNetwork& network) const {
+        for (const TripSpec& t : demand) network.spawnVehicle(t.vehicleID, t.startNode, t.destNode, t.isEmergency, t.spawnTime);
+    }
+};
+
+#endif // SCENARIO_H
@@ -0,0 +1,33 @@
+#ifndef SIGNALPLAN_H
+#define SIGNALPLAN_H
+
+// Tunable parameters for the adaptive traffic light controller.
+// The defaults reproduce the original hardcoded behaviour.
+struct SignalPlan {
+    double secondsPerQueuedCar;       // Green time granted per waiting car
+    double minGreen;                  // Lower clamp for normal green phases
+    double maxGreen;                  // Upper clamp so one road can't block others forever
+    double secondsPerCarAheadOfEmergency; // Generous per-car time to clear cars in front of an ambulance
+    double emergencyMinGreen;         // Safe minimum for emergency phases (no maximum)
+
+    SignalPlan(double perCar = 2.0, double minG = 5.0, double maxG = 30.0,
+               double perCarEmergency = 2.5, double emergencyMin = 10.0)
+        : secondsPerQueuedCar(perCar), minGreen(minG), maxGreen(maxG),
+          secondsPerCarAheadOfEmergency(perCarEmergency), emergencyMinGreen(emergencyMin) {}
+
+    // Normal (fairness) logic: time proportional to queue, clamped to [minGreen, maxGreen]
+    double normalGreenDuration(double queueSize) const {
+        double neededTime = queueSize * secondsPerQueuedCar;
+        if (neededTime < minGreen) return minGreen;
+        if (neededTime > maxGreen) return maxGreen;
+        return neededTime;
+    }
+
+    // Emergency logic: clear everything UP TO and including the ambulance
+    double emergencyGreenDuration(int ambulanceIndex) const {
+        double timeToClear = (ambulanceIndex + 1) * secondsPerCarAheadOfEmergency;
+        return (timeToClear < emergencyMinGreen) ? emergencyMinGreen : timeToClear;
+    }
+};
+
+#endif // SIGNALPLAN_H
@@ -0,0 +1,80 @@
+#include "SignalPlanEvaluator.h"
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+SignalPlanEvaluator::SignalPlanEvaluator(const Scenario& scenario, int numThreads)
+    : throughputWeight(1.0), delayWeight(1.0), emergencyWeight(2.0), strandedEmergencyWeight(10.0),
+      scenario(scenario), numThreads(numThreads) {
+    if (this->numThreads <= 0) {
+        this->numThreads = (int)std::thread::hardware_concurrency();
+        if (this->numThreads <= 0) this->numThreads = 1;
+    }
+}
+
+PlanScore SignalPlanEvaluator::evaluateOne(const SignalPlan& plan) const {
+    TrafficNetwork network(scenario.seed);
+    network.setHeadless(true);
+    network.setSignalPlan(plan);
+    scenario.buildNetwork(network);
+    network.runSimulation(scenario.duration);
+
+    PlanScore result;
+    result.plan = plan;
+    result.stats = network.getStatistics();
+    result.score = throughputWeight * result.stats.tripsCompleted
+                 - delayWeight * result.stats.getAverageDelay()
+                 - emergencyWeight * result.stats.getAverageEmergencyClearanceTime()
+                 - strandedEmergencyWeight * result.stats.emergencyTripsUnfinished;
+    return result;
+}
+
+std::vector<PlanScore> SignalPlanEvaluator::evaluate(const std::vector<SignalPlan>& plans) const {
+    std::vector<PlanScore> results(plans.size());
+    if (plans.empty()) return results;
+
+    // Workers pull the next unevaluated plan index until all are done
+    std::atomic<size_t> nextPlan(0);
+    auto worker = [&]() {
+        for (size_t i = nextPlan++; i < plans.size(); i = nextPlan++) {
+            results[i] = evaluateOne(plans[i]);
+        }
+    };
+
+    int threadCount = std::min<int>(numThreads, (int)plans.size());
+    std::vector<std::thread> threads;
+    for (int t = 1; t < threadCount; ++t) {
+        threads.emplace_back(worker);
+    }
+    worker(); // The calling thread works too
+    for (std::thread& t : threads) t.join();
+
+    return results;
+}
+
+int SignalPlanEvaluator::bestPlanIndex(const std::vector<PlanScore>& scores) {
+    int best = -1;
+    for (size_t i = 0; i < scores.size(); ++i) {
+        if (best == -1 || scores[i].score > scores[best].score) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+std::vector<SignalPlan> SignalPlanEvaluator::makeGrid(const std::vector<double>& perCarValues,
+                                                      const std::vector<double>& minGreenValues,
+                                                      const std::vector<double>& maxGreenValues,
+                                                      const std::vector<double>& perCarEmergencyValues,
+                                                      const std::vector<double>& emergencyMinValues) {
+    std::vector<SignalPlan> plans;
+    for (double perCar : perCarValues)
+        for (double minG : minGreenValues)
+            for (double maxG : maxGreenValues) {
+                if (maxG < minG) continue; // Invalid clamp
+                for (double perCarEmergency : perCarEmergencyValues)
+                    for (double emergencyMin : emergencyMinValues)
+                        plans.push_back(SignalPlan(perCar, minG, maxG, perCarEmergency, emergencyMin));
+            }
+    return plans;
+}
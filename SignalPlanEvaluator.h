@@ -0,0 +1,48 @@
+#ifndef SIGNALPLANEVALUATOR_H
+#define SIGNALPLANEVALUATOR_H
+
+#include <vector>
+#include "Scenario.h"
+#include "SignalPlan.h"
+#include "SimulationStats.h"
+
+struct PlanScore {
+    SignalPlan plan;
+    SimulationStats stats;
+    double score; // Higher is better
+};
+
+// Runs many candidate signal plans against the same scenario in parallel.
+// Each worker thread owns its own headless TrafficNetwork, so runs share no state.
+class SignalPlanEvaluator {
+public:
+    // Score weights: throughput is rewarded; delay, ambulance trip time and
+    // ambulances still en route at the end of the run are penalised
+    double throughputWeight;
+    double delayWeight;
+    double emergencyWeight;
+    double strandedEmergencyWeight;
+
+    SignalPlanEvaluator(const Scenario& scenario, int numThreads = 0);
+
+    // Returns one score per plan, in the same order as the input
+    std::vector<PlanScore> evaluate(const std::vector<SignalPlan>& plans) const;
+
+    // Convenience: index of the best-scoring plan (-1 if empty)
+    static int bestPlanIndex(const std::vector<PlanScore>& scores);
+
+    // Cartesian product of candidate values for the normal and emergency parameters
+    static std::vector<SignalPlan> makeGrid(const std::vector<double>& perCarValues,
+                                            const std::vector<double>& minGreenValues,
+                                            const std::vector<double>& maxGreenValues,
+                                            const std::vector<double>& perCarEmergencyValues,
+                                            const std::vector<double>& emergencyMinValues);
+
+private:
+    const Scenario& scenario;
+    int numThreads;
+
+    PlanScore evaluateOne(const SignalPlan& plan) const;
+};
+
+#endif // SIGNALPLANEVALUATOR_H
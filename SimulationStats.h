@@ -0,0 +1,42 @@
+#ifndef SIMULATIONSTATS_H
+#define SIMULATIONSTATS_H
+
+// Aggregate trip metrics collected while the simulation runs.
+// Used for the end-of-run report and for scoring signal plans.
+struct SimulationStats {
+    int tripsCompleted;
+    int emergencyTripsCompleted;
+    double totalTripTime;          // Sum of (arrival - spawn) over all completed trips
+    double totalDelay;             // Sum of (trip time - free-flow time)
+    double totalEmergencyTripTime; // Sum of trip times for emergency vehicles only
+
+    // Vehicles still en route when the run ended, so stranding traffic isn't free
+    int tripsUnfinished;
+    int emergencyTripsUnfinished;
+    double totalUnfinishedDelay;          // Elapsed time minus free-flow time for the distance covered
+    double totalUnfinishedEmergencyTime;  // Elapsed time of ambulances still en route
+
+    SimulationStats()
+        : tripsCompleted(0), emergencyTripsCompleted(0), totalTripTime(0.0),
+          totalDelay(0.0), totalEmergencyTripTime(0.0), tripsUnfinished(0),
+          emergencyTripsUnfinished(0), totalUnfinishedDelay(0.0), totalUnfinishedEmergencyTime(0.0) {}
+
+    double getAverageTripTime() const {
+        return (tripsCompleted == 0) ? 0.0 : totalTripTime / tripsCompleted;
+    }
+
+    // Includes delay accumulated so far by unfinished trips
+    double getAverageDelay() const {
+        int trips = tripsCompleted + tripsUnfinished;
+        return (trips == 0) ? 0.0 : (totalDelay + totalUnfinishedDelay) / trips;
+    }
+
+    // Average time an ambulance needs to get from spawn to destination.
+    // Ambulances still en route count with their elapsed time (a lower bound).
+    double getAverageEmergencyClearanceTime() const {
+        int trips = emergencyTripsCompleted + emergencyTripsUnfinished;
+        return (trips == 0) ? 0.0 : (totalEmergencyTripTime + totalUnfinishedEmergencyTime) / trips;
+    }
+};
+
+#endif // SIMULATIONSTATS_H
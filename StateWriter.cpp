@@ -0,0 +1,142 @@
+#include "StateWriter.h"
+
+StateWriter::StateWriter(std::FILE* out, size_t numFrames, size_t chunkBytes)
+    : out(out), chunkBytes(chunkBytes), frames(numFrames < 2 ? 2 : numFrames), writeIndex(0), readIndex(0),
+      readyCount(0), reservedVehicles(0), reservedLights(0), dropWhenFull(false), droppedFrames(0),
+      stopping(false), running(false) {
+    pending.reserve(chunkBytes * 2);
+}
+
+StateWriter::~StateWriter() {
+    stop();
+}
+
+void StateWriter::start() {
+    if (running) return;
+    stopping = false;
+    running = true;
+    worker = std::thread(&StateWriter::run, this);
+}
+
+void StateWriter::stop() {
+    if (!running) return;
+
+    // Don't lose log lines emitted after the last frame (never dropped)
+    if (!frames[writeIndex].messages.empty()) commit(false);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    cv.notify_all();
+    worker.join();
+    running = false;
+
+    if (droppedFrames > 0) {
+        pending += "[OUTPUT] Dropped " + std::to_string(droppedFrames) + " frames while the output was behind\n";
+    }
+    if (!pending.empty()) {
+        std::fwrite(pending.data(), 1, pending.size(), out);
+        pending.clear();
+    }
+    std::fflush(out);
+}
+
+void StateWriter::ensureCapacity(size_t numVehicles, size_t numLights) {
+    if (numVehicles <= reservedVehicles && numLights <= reservedLights) return;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (numVehicles > reservedVehicles) reservedVehicles = numVehicles * 2;
+    if (numLights > reservedLights) reservedLights = numLights;
+
+    // Slots queued for the writer are grown when they come back around in commitFrame
+    for (size_t i = readyCount; i < frames.size(); ++i) {
+        reserveSlot(frames[(readIndex + i) % frames.size()]);
+    }
+}
+
+void StateWriter::reserveSlot(FrameSnapshot& frame) {
+    if (frame.vehicles.capacity() < reservedVehicles) frame.vehicles.reserve(reservedVehicles);
+    if (frame.lights.capacity() < reservedLights) frame.lights.reserve(reservedLights);
+}
+
+void StateWriter::commitFrame() {
+    commit(dropWhenFull);
+}
+
+void StateWriter::commit(bool mayDrop) {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (mayDrop && readyCount >= frames.size() - 1) {
+            // Ring full: discard this frame's state but keep its log lines
+            // so they go out with the next frame that gets through
+            FrameSnapshot& frame = frames[writeIndex];
+            frame.hasState = false;
+            frame.vehicles.clear();
+            frame.lights.clear();
+            droppedFrames++;
+            return;
+        }
+
+        // The new back slot must not be queued or being formatted, so wait only
+        // if every other slot is still waiting for the writer
+        cv.wait(lock, [this] { return readyCount < frames.size() - 1; });
+        readyCount++;
+        writeIndex = (writeIndex + 1) % frames.size();
+        reserveSlot(frames[writeIndex]);
+    }
+    cv.notify_all();
+
+    // The writer is done with this slot, so it's safe to reuse
+    frames[writeIndex].clear();
+}
+
+void StateWriter::run() {
+    while (true) {
+        size_t frontIndex;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [this] { return readyCount > 0 || stopping; });
+            if (readyCount == 0) break; // Stopping and nothing left to write
+            frontIndex = readIndex;
+        }
+
+        formatFrame(frames[frontIndex], pending);
+
+        // Hand the slot back before writing, so the simulation never waits on I/O
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            readIndex = (readIndex + 1) % frames.size();
+            readyCount--;
+        }
+        cv.notify_all();
+
+        if (pending.size() >= chunkBytes) {
+            std::fwrite(pending.data(), 1, pending.size(), out);
+            pending.clear();
+        }
+    }
+}
+
+void StateWriter::formatFrame(const FrameSnapshot& frame, std::string& out) {
+    char line[96];
+
+    for (const std::string& msg : frame.messages) {
+        out += msg;
+        out += '\n';
+    }
+    if (!frame.hasState) return;
+
+    // Same format the visualizer parses: STATE t / V id road pos / L node road / END_STATE
+    std::snprintf(line, sizeof(line), "STATE %g\n", frame.time);
+    out += line;
+    for (const FrameSnapshot::VehicleRecord& v : frame.vehicles) {
+        std::snprintf(line, sizeof(line), "V %d %d %g\n", v.id, v.roadID, v.position);
+        out += line;
+    }
+    for (const FrameSnapshot::LightRecord& l : frame.lights) {
+        std::snprintf(line, sizeof(line), "L %d %d\n", l.intersectionID, l.greenRoadID);
+        out += line;
+    }
+    out += "END_STATE\n";
+}
@@ -0,0 +1,104 @@
+#ifndef STATEWRITER_H
+#define STATEWRITER_H
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// Compact copy of everything the visualizer needs from one tick
+struct FrameSnapshot {
+    struct VehicleRecord {
+        int id;
+        int roadID;
+        double position;
+    };
+
+    struct LightRecord {
+        int intersectionID;
+        int greenRoadID;
+    };
+
+    bool hasState; // False for frames that only carry log messages
+    double time;
+    std::vector<VehicleRecord> vehicles;
+    std::vector<LightRecord> lights;
+    std::vector<std::string> messages; // Log lines emitted since the previous frame
+
+    FrameSnapshot() : hasState(false), time(0.0) {}
+
+    // Keeps capacity so the buffer is reused without reallocating
+    void clear() {
+        hasState = false;
+        vehicles.clear();
+        lights.clear();
+        messages.clear();
+    }
+};
+
+// Ring-buffered output stage.
+// The simulation thread fills the back frame of a ring of preallocated
+// snapshots and commits it; a background thread formats committed frames and
+// writes the text out in large chunks. A slot is handed back as soon as it is
+// formatted, before the write.
+//
+// The writer formats and writes on the same thread, so if the output is
+// back-pressured (full pipe, slow terminal) formatting stalls too and the ring
+// fills up. What happens then depends on the overflow policy:
+//   - lossless (default): commitFrame waits for a free slot, so the
+//     simulation does wait on the terminal or disk, but every frame is kept;
+//   - drop: the new frame's state is discarded (log lines are kept for the
+//     next frame) and the tick loop never blocks.
+class StateWriter {
+public:
+    StateWriter(std::FILE* out = stdout, size_t numFrames = 8, size_t chunkBytes = 1 << 16);
+    ~StateWriter();
+
+    void start();
+    void stop(); // Flushes pending frames and joins the writer thread
+
+    // Make sure frames can hold this many records without reallocating during capture.
+    // Grows the reservation geometrically, so repeated calls as the fleet grows are cheap.
+    void ensureCapacity(size_t numVehicles, size_t numLights);
+
+    // Back frame for the simulation thread to fill
+    FrameSnapshot& backBuffer() { return frames[writeIndex]; }
+    void commitFrame();
+
+    // Overflow policy when the ring is full; see the class comment
+    void setDropWhenFull(bool enabled) { dropWhenFull = enabled; }
+    size_t getDroppedFrames() const { return droppedFrames; }
+
+    // Queue a log line so it is written in order with the frames
+    void log(const std::string& line) { frames[writeIndex].messages.push_back(line); }
+
+    static void formatFrame(const FrameSnapshot& frame, std::string& out);
+
+private:
+    std::FILE* out;
+    size_t chunkBytes;
+    std::string pending; // Formatted text not yet written (writer thread only)
+
+    std::vector<FrameSnapshot> frames;
+    size_t writeIndex;   // Slot the simulation is filling
+    size_t readIndex;    // Oldest committed slot (the one the writer formats next)
+    size_t readyCount;   // Committed slots the writer hasn't finished formatting
+    size_t reservedVehicles;
+    size_t reservedLights;
+    bool dropWhenFull;
+    size_t droppedFrames;
+    bool stopping;
+    bool running;
+
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    void reserveSlot(FrameSnapshot& frame);
+    void commit(bool mayDrop);
+    void run();
+};
+
+#endif // STATEWRITER_H
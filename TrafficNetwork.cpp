@@ -1,8 +1,16 @@
 #include "TrafficNetwork.h"
 #include <limits>
 #include <algorithm>
+#include <sstream>
+#include <fstream>
+#include <cmath>
+#include <memory>
 
-TrafficNetwork::TrafficNetwork() : currentTime(0.0) {}
+static const long long MAX_PROFILE_BREAKPOINTS = 1000000; // Sanity limit when loading profiles
+
+TrafficNetwork::TrafficNetwork(unsigned int seed) : currentTime(0.0), lastPrint(0.0), outputInterval(0.5), dropOutputFrames(false),
+      headless(false), stateWriter(nullptr), rng(seed), predictiveRouting(false),
+      ingestBatchSize(1024), nextVehicleID(0) {}
 
 TrafficNetwork::~TrafficNetwork() {
     for (auto& pair : intersections) delete pair.second;
@@ -29,38 +37,33 @@ void TrafficNetwork::printStaticGraph() {
 }
 
 void TrafficNetwork::printNetworkState() {
-    std::cout << "STATE " << currentTime << std::endl;
-    for (auto& pair : vehicles) {
-        Vehicle* v = pair.second;
-        if (v->isMoving) {
-            // Output: V ID RoadID Position
-            // We need to find the Road ID based on path[pathIndex] -> path[pathIndex+1]
-            // This is a bit inefficient to search every time, but fine for this scale.
-            int u = v->path[v->pathIndex];
-            int nextNode = v->path[v->pathIndex + 1];
-            // Find road ID
-            int roadID = -1;
-            if (intersections.find(u) != intersections.end()) {
-                for (Road* r : intersections[u]->outgoingRoads) {
-                    if (r->destinationID == nextNode) {
-                        roadID = r->id;
-                        break;
-                    }
-                }
-            }
-            std::cout << "V " << v->id << " " << roadID << " " << v->currentPosition << std::endl;
+    FrameSnapshot frame;
+    captureNetworkState(frame);
+    std::string text;
+    StateWriter::formatFrame(frame, text);
+    std::cout << text << std::flush;
+}
+
+void TrafficNetwork::captureNetworkState(FrameSnapshot& frame) {
+    frame.hasState = true;
+    frame.time = currentTime;
+
+    // Every moving vehicle sits in exactly one road queue, so walking the queues
+    // gives the road ID directly instead of searching by path for each vehicle.
+    for (Road* r : roads) {
+        for (Vehicle* v : r->vehicleQueue) {
+            frame.vehicles.push_back({v->id, r->id, v->currentPosition});
         }
     }
-    // Also output traffic lights
+    // Also capture traffic lights
     for (auto& pair : intersections) {
         Intersection* i = pair.second;
         int greenRoadId = -1;
         if (i->greenLightRoadIndex != -1 && i->greenLightRoadIndex < i->incomingRoads.size()) {
             greenRoadId = i->incomingRoads[i->greenLightRoadIndex]->id;
         }
-        std::cout << "L " << i->id << " " << greenRoadId << std::endl;
+        frame.lights.push_back({i->id, greenRoadId});
     }
-    std::cout << "END_STATE" << std::endl;
 }
 
 void TrafficNetwork::addRoad(int id, int source, int dest, double length, double speedLimit) {
@@ -76,15 +79,17 @@ void TrafficNetwork::addRoad(int id, int source, int dest, double length, double
 }
 
 void TrafficNetwork::scheduleEvent(double time, EventType type, int entityID, int secondaryID) {
-    eventQueue.push({time, type, entityID, secondaryID});
+    eventQueue.push({time, type, entityID, secondaryID, 0.0});
 }
 
 void TrafficNetwork::spawnVehicle(int id, int startNode, int destNode, bool isEmergency, double spawnTime) {
     Vehicle* v = new Vehicle(id, startNode, destNode, isEmergency, spawnTime);
     vehicles[id] = v;
+    if (id >= nextVehicleID) nextVehicleID = id + 1;
+    if (stateWriter) stateWriter->ensureCapacity(vehicles.size(), intersections.size()); // Injected mid-run
     
-    // Calculate initial path
-    std::vector<int> path = calculateShortestPath(startNode, destNode);
+    // Calculate initial path for the time the vehicle will actually depart
+    std::vector<int> path = findRoute(startNode, destNode, spawnTime);
     v->setPath(path);
     
     // Schedule first arrival event (at the next intersection)
@@ -103,7 +108,6 @@ void TrafficNetwork::spawnVehicle(int id, int startNode, int destNode, bool isEm
         }
         
         if (roadToTake) {
-            roadToTake->currentVehicleCount++;
             // Calculate travel time = Distance / Speed
             // We use static speed limit for initial estimate, or dynamic?
             // Let's use dynamic weight logic but for time: Time = Distance / (Speed * (1-Congestion))
@@ -115,19 +119,28 @@ void TrafficNetwork::spawnVehicle(int id, int startNode, int destNode, bool isEm
 }
 
 std::vector<int> TrafficNetwork::calculateShortestPath(int startNode, int destNode) {
-    // Dijkstra's Algorithm
+    // Static weights: cost of a road doesn't depend on when it is reached
+    return dijkstra(startNode, destNode, 0.0, [](const Road* road, double) {
+        return road->getDynamicWeight();
+    });
+}
+
+std::vector<int> TrafficNetwork::dijkstra(int startNode, int destNode, double startLabel,
+                                          const std::function<double(const Road*, double)>& edgeCost) {
+    // Dijkstra's Algorithm. Labels are accumulated cost from startLabel; edgeCost
+    // gets the label at the road's source so costs can depend on arrival time.
     std::unordered_map<int, double> dist;
     std::unordered_map<int, int> prev;
     
     for (auto& pair : intersections) {
         dist[pair.first] = std::numeric_limits<double>::infinity();
     }
-    dist[startNode] = 0.0;
+    dist[startNode] = startLabel;
     
     // Priority Queue for Dijkstra: <Distance, NodeID>
     // Use std::greater for Min-Heap
     std::priority_queue<std::pair<double, int>, std::vector<std::pair<double, int>>, std::greater<std::pair<double, int>>> pq;
-    pq.push({0.0, startNode});
+    pq.push({startLabel, startNode});
     
     while (!pq.empty()) {
         double d = pq.top().first;
@@ -141,7 +154,7 @@ std::vector<int> TrafficNetwork::calculateShortestPath(int startNode, int destNo
 
         for (Road* road : intersections[u]->outgoingRoads) {
             int v = road->destinationID;
-            double weight = road->getDynamicWeight();
+            double weight = edgeCost(road, dist[u]);
             
             if (dist[u] + weight < dist[v]) {
                 dist[v] = dist[u] + weight;
@@ -168,22 +181,98 @@ std::vector<int> TrafficNetwork::calculateShortestPath(int startNode, int destNo
     return path;
 }
 
+std::vector<int> TrafficNetwork::calculateTimeDependentPath(int startNode, int destNode, double departureTime) {
+    // Time-dependent Dijkstra: labels are arrival times, and each road is
+    // costed by its predicted travel time at the moment the vehicle reaches it
+    return dijkstra(startNode, destNode, departureTime, [](const Road* road, double arrivalTime) {
+        return road->getPredictedTravelTime(arrivalTime);
+    });
+}
+
+std::vector<int> TrafficNetwork::findRoute(int startNode, int destNode, double departureTime) {
+    if (!predictiveRouting) {
+        return calculateShortestPath(startNode, destNode);
+    }
+
+    std::vector<int> path;
+    if (routeCache.lookup(startNode, destNode, departureTime, currentTime, path)) {
+        return path;
+    }
+    path = calculateTimeDependentPath(startNode, destNode, departureTime);
+    routeCache.insert(startNode, destNode, departureTime, currentTime, path);
+    return path;
+}
+
+bool TrafficNetwork::saveTravelTimeProfiles(const std::string& filename) {
+    std::ofstream file(filename);
+    if (!file) return false;
+
+    // Format: PROFILE roadID interval count, then one "time observations" line per breakpoint
+    for (Road* r : roads) {
+        const TravelTimeProfile& p = r->travelTimeProfile;
+        if (!p.hasData()) continue;
+        file << "PROFILE " << r->id << " " << p.interval << " " << p.times.size() << "\n";
+        for (size_t i = 0; i < p.times.size(); ++i) {
+            file << p.times[i] << " " << p.counts[i] << "\n";
+        }
+    }
+    return (bool)file;
+}
+
+bool TrafficNetwork::loadTravelTimeProfiles(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file) return false;
+
+    std::unordered_map<int, Road*> roadsByID;
+    for (Road* r : roads) roadsByID[r->id] = r;
 
+    // Parse everything first so a malformed file leaves the current profiles untouched
+    std::unordered_map<Road*, TravelTimeProfile> loaded;
+    std::string tag;
+    while (file >> tag) {
+        if (tag != "PROFILE") return false;
+        int roadID;
+        double interval;
+        long long count;
+        if (!(file >> roadID >> interval >> count)) return false;
+        if (!std::isfinite(interval) || interval <= 0.0) return false;
+        if (count < 0 || count > MAX_PROFILE_BREAKPOINTS) return false;
+
+        TravelTimeProfile profile(interval);
+        profile.times.resize(count);
+        profile.counts.resize(count);
+        for (long long i = 0; i < count; ++i) {
+            double time;
+            long observations;
+            if (!(file >> time >> observations)) return false;
+            if (!std::isfinite(time) || time < 0.0 || observations < 0 || observations > 65535) return false;
+            profile.times[i] = (float)time;
+            profile.counts[i] = (unsigned short)observations;
+        }
+
+        auto it = roadsByID.find(roadID);
+        if (it != roadsByID.end()) loaded[it->second] = profile;
+    }
+
+    for (auto& pair : loaded) pair.first->travelTimeProfile = pair.second;
+    routeCache.clear(); // Cached routes were computed from the old profiles
+    return true;
+}
 
 void TrafficNetwork::resetVehicle(Vehicle* v) {
     // Pick random start and end nodes
     int numNodes = intersections.size();
     if (numNodes < 2) return;
 
-    int startNode = std::rand() % numNodes;
-    int destNode = std::rand() % numNodes;
+    int startNode = rng() % numNodes;
+    int destNode = rng() % numNodes;
     while (destNode == startNode) {
-        destNode = std::rand() % numNodes;
+        destNode = rng() % numNodes;
     }
 
     v->currentIntersectionID = startNode;
     v->destinationID = destNode;
-    v->path = calculateShortestPath(startNode, destNode);
+    v->path = findRoute(startNode, destNode, currentTime);
     v->pathIndex = 0;
     v->currentPosition = 0.0;
     v->isMoving = false; // Set to false so the spawn logic picks it up
@@ -193,6 +282,18 @@ void TrafficNetwork::resetVehicle(Vehicle* v) {
 
 void TrafficNetwork::runSimulation(double duration) {
     double timeStep = 0.1; // 100ms per step
+
+    // Snapshots are copied into a ring of preallocated frames and serialized on a
+    // background thread. Headless runs never build the output stage at all.
+    std::unique_ptr<StateWriter> writer;
+    if (!headless) {
+        std::cout << std::flush;
+        writer.reset(new StateWriter(stdout));
+        writer->ensureCapacity(vehicles.size(), intersections.size());
+        writer->setDropWhenFull(dropOutputFrames);
+        writer->start();
+        stateWriter = writer.get();
+    }
     
     // Initial events
     for (auto& pair : intersections) {
@@ -200,7 +301,10 @@ void TrafficNetwork::runSimulation(double duration) {
     }
     
     while (currentTime < duration) {
-        // 1. Process Events (Traffic Lights)
+        // 0. Pull in events injected by other threads (never blocks)
+        drainIngestQueue();
+
+        // 1. Process Events (Traffic Lights, Incidents, Demand)
         while (!eventQueue.empty() && eventQueue.top().timestamp <= currentTime) {
             Event e = eventQueue.top();
             eventQueue.pop();
@@ -211,6 +315,7 @@ void TrafficNetwork::runSimulation(double duration) {
         for (auto& pair : vehicles) {
             Vehicle* v = pair.second;
             if (!v->isMoving && v->currentPosition == 0 && v->pathIndex == 0 && v->arrivalTime < 0) {
+                 if (v->path.size() < 2) continue; // No route (e.g. cut off by closures)
                  if (currentTime >= v->spawnTime) {
                      // Try to enter first road
                      int u = v->path[v->pathIndex];
@@ -230,7 +335,7 @@ void TrafficNetwork::runSimulation(double duration) {
                      if (startRoad) {
                          // Check if space available at start of road
                          // Last vehicle in queue must be > length + gap
-                         bool spaceAvailable = true;
+                         bool spaceAvailable = !startRoad->closed;
                          if (!startRoad->vehicleQueue.empty()) {
                              Vehicle* last = startRoad->vehicleQueue.back();
                              if (last->currentPosition < (v->length + v->minGap)) {
@@ -240,8 +345,7 @@ void TrafficNetwork::runSimulation(double duration) {
                          
                          if (spaceAvailable) {
                              v->isMoving = true;
-                             v->currentPosition = 0.0; // Start at 0
-                             startRoad->vehicleQueue.push_back(v);
+                             enterRoad(v, startRoad);
                          }
                      }
                  }
@@ -254,7 +358,7 @@ void TrafficNetwork::runSimulation(double duration) {
 
             for (size_t i = 0; i < r->vehicleQueue.size(); ++i) {
                 Vehicle* v = r->vehicleQueue[i];
-                double moveDist = 10.0 * timeStep; // Speed 10 m/s
+                double moveDist = VEHICLE_SPEED * timeStep;
                 double limit = r->baseDistance; // Default limit is end of road
                 
                 if (i == 0) {
@@ -307,7 +411,7 @@ void TrafficNetwork::runSimulation(double duration) {
                             }
                             
                             if (nextRoad) {
-                                bool space = true;
+                                bool space = !nextRoad->closed;
                                 if (!nextRoad->vehicleQueue.empty()) {
                                     Vehicle* last = nextRoad->vehicleQueue.back();
                                     if (last->currentPosition < (front->length + front->minGap)) {
@@ -316,18 +420,23 @@ void TrafficNetwork::runSimulation(double duration) {
                                 }
                                 
                                 if (space) {
-                                    r->vehicleQueue.pop_front();
+                                    leaveRoad(front, r);
                                     front->pathIndex++;
-                                    front->currentPosition = 0.0;
-                                    nextRoad->vehicleQueue.push_back(front);
+                                    enterRoad(front, nextRoad);
                                 } else {
                                     front->currentPosition = r->baseDistance;
                                 }
                             }
                         } else {
-                            // Reached Destination -> RECYCLE
-                            r->vehicleQueue.pop_front();
-                            resetVehicle(front);
+                            // Reached Destination -> RECYCLE (injected trips are retired)
+                            leaveRoad(front, r);
+                            recordTrip(front);
+                            if (front->oneShot) {
+                                vehicles.erase(front->id);
+                                delete front;
+                            } else {
+                                resetVehicle(front);
+                            }
                         }
                     }
                 }
@@ -335,14 +444,21 @@ void TrafficNetwork::runSimulation(double duration) {
         }
 
         // 4. Output State (Snapshot)
-        static double lastPrint = 0.0;
-        if (currentTime - lastPrint >= 0.5) {
-            printNetworkState();
+        if (stateWriter && currentTime - lastPrint >= outputInterval) {
+            captureNetworkState(stateWriter->backBuffer());
+            stateWriter->commitFrame();
             lastPrint = currentTime;
         }
 
         currentTime += timeStep;
     }
+
+    recordUnfinishedTrips();
+
+    if (writer) {
+        writer->stop();
+        stateWriter = nullptr;
+    }
 }
 
 
@@ -358,8 +474,8 @@ void TrafficNetwork::processEvent(const Event& event) {
             // 1. Decide WHICH road gets green (This handles the switch)
             int greenRoadID = intersection->decideNextGreenLight(currentTime);
             
-            // 2. Decide HOW LONG (Adaptive Timing)
-            double greenDuration = 5.0; // Default minimum
+            // 2. Decide HOW LONG (Adaptive Timing, parameters come from the signal plan)
+            double greenDuration = signalPlan.minGreen; // Default minimum
             
             // Find the active road object
             Road* activeRoad = nullptr;
@@ -382,26 +498,21 @@ void TrafficNetwork::processEvent(const Event& event) {
 
                 if (ambulanceIndex != -1) {
                     // --- EMERGENCY LOGIC ---
-                    // Calculate time needed to clear everything UP TO the ambulance.
-                    // We use a slightly generous multiplier (2.5s per car) to ensure it definitely clears.
-                    double timeToClear = (ambulanceIndex + 1) * 2.5; 
-                    
-                    // Enforce a safe minimum (e.g. 10s), but NO MAXIMUM limit.
+                    // Clear everything UP TO the ambulance, with a safe minimum but NO MAXIMUM.
                     // The light stays green until the ambulance is predicted to leave.
-                    greenDuration = (timeToClear < 10.0) ? 10.0 : timeToClear;
+                    greenDuration = signalPlan.emergencyGreenDuration(ambulanceIndex);
 
-                    std::cout << "[EMERGENCY] Extending Green Light to " << greenDuration 
-                              << "s for Ambulance at queue position " << ambulanceIndex << std::endl;
+                    if (stateWriter) {
+                        std::ostringstream msg;
+                        msg << "[EMERGENCY] Extending Green Light to " << greenDuration 
+                            << "s for Ambulance at queue position " << ambulanceIndex;
+                        stateWriter->log(msg.str());
+                    }
                 } 
                 else {
                     // --- NORMAL LOGIC (Fairness) ---
-                    double queueSize = activeRoad->getQueueLength();
-                    double neededTime = queueSize * 2.0; 
-                    
-                    // Cap at 30 seconds so normal traffic doesn't block others forever
-                    if (neededTime < 5.0) greenDuration = 5.0;
-                    else if (neededTime > 30.0) greenDuration = 30.0;
-                    else greenDuration = neededTime;
+                    // Capped so normal traffic doesn't block others forever
+                    greenDuration = signalPlan.normalGreenDuration(activeRoad->getQueueLength());
                 }
             }
 
@@ -409,4 +520,183 @@ void TrafficNetwork::processEvent(const Event& event) {
             scheduleEvent(currentTime + greenDuration, LIGHT_CHANGE, intersectionID);
         }
     }
+    else if (event.type == VEHICLE_SPAWN || event.type == EMERGENCY_DISPATCH) {
+        // Injected demand: entityID = start node, secondaryID = destination node
+        if (intersections.find(event.entityID) == intersections.end() ||
+            intersections.find(event.secondaryID) == intersections.end() ||
+            event.entityID == event.secondaryID) return;
+
+        int id = nextVehicleID;
+        spawnVehicle(id, event.entityID, event.secondaryID, event.type == EMERGENCY_DISPATCH, currentTime);
+        vehicles[id]->oneShot = true; // One trip, not a permanent addition to the fleet
+    }
+    else if (event.type == ROAD_CLOSURE || event.type == ROAD_REOPEN) {
+        Road* road = findRoad(event.entityID);
+        if (!road) return;
+
+        road->closed = (event.type == ROAD_CLOSURE);
+        routeCache.clear(); // Cached routes may use the closed road or miss the reopened one
+        rerouteVehicles();
+
+        if (stateWriter) {
+            std::ostringstream msg;
+            msg << "[INCIDENT] Road " << road->id << (road->closed ? " closed" : " reopened") << " at t=" << currentTime;
+            stateWriter->log(msg.str());
+        }
+    }
+    else if (event.type == CAPACITY_CHANGE) {
+        Road* road = findRoad(event.entityID);
+        if (!road) return;
+
+        // Capacity below one car would make getCongestionFactor() report an empty,
+        // free-flowing road (a road that takes no cars should be sent as ROAD_CLOSURE),
+        // and anything past INT_MAX can't be stored. NaN fails both comparisons.
+        if (!(event.value >= 1.0 && event.value <= std::numeric_limits<int>::max())) {
+            if (stateWriter) {
+                std::ostringstream msg;
+                msg << "[INCIDENT] Ignored invalid capacity " << event.value << " for Road " << road->id;
+                stateWriter->log(msg.str());
+            }
+            return;
+        }
+
+        road->capacity = (int)event.value;
+        routeCache.clear(); // Dynamic weights changed
+
+        if (stateWriter) {
+            std::ostringstream msg;
+            msg << "[INCIDENT] Road " << road->id << " capacity set to " << road->capacity << " at t=" << currentTime;
+            stateWriter->log(msg.str());
+        }
+    }
+}
+
+void TrafficNetwork::drainIngestQueue() {
+    Event e;
+    size_t count = 0;
+    while (count < ingestBatchSize && ingestQueue.pop(e)) {
+        // Late arrivals from the feed are handled now rather than in the past
+        if (e.timestamp < currentTime) e.timestamp = currentTime;
+        eventQueue.push(e);
+        count++;
+    }
+}
+
+Road* TrafficNetwork::findRoad(int id) {
+    for (Road* r : roads) {
+        if (r->id == id) return r;
+    }
+    return nullptr;
+}
+
+void TrafficNetwork::enterRoad(Vehicle* v, Road* r) {
+    v->currentPosition = 0.0; // Start at 0
+    v->roadEntryTime = currentTime;
+    r->vehicleQueue.push_back(v);
+    r->currentVehicleCount++;
+}
+
+// Assumes v is at the front of r's queue
+void TrafficNetwork::leaveRoad(Vehicle* v, Road* r) {
+    r->vehicleQueue.pop_front();
+    r->currentVehicleCount--;
+    r->travelTimeProfile.addObservation(v->roadEntryTime, currentTime - v->roadEntryTime);
+}
+
+void TrafficNetwork::rerouteVehicles() {
+    for (auto& pair : vehicles) {
+        Vehicle* v = pair.second;
+        if (!v->isMoving && v->arrivalTime >= 0) continue; // Finished, awaiting recycle
+
+        // Vehicles still waiting to enter the network can change their whole route;
+        // moving vehicles keep their current road and replan from its end
+        int firstHop = v->isMoving ? v->pathIndex + 1 : 0;
+
+        bool blocked = (v->path.size() < 2);
+        for (size_t i = firstHop; !blocked && i + 1 < v->path.size(); ++i) {
+            if (intersections.find(v->path[i]) == intersections.end()) continue;
+            for (Road* r : intersections[v->path[i]]->outgoingRoads) {
+                if (r->destinationID == v->path[i + 1]) {
+                    blocked = r->closed;
+                    break;
+                }
+            }
+        }
+        if (!blocked) continue;
+
+        if (!v->isMoving) {
+            // Plan for when the vehicle will actually depart, as spawnVehicle does
+            v->setPath(findRoute(v->currentIntersectionID, v->destinationID, std::max(currentTime, v->spawnTime)));
+            continue;
+        }
+
+        std::vector<int> tail = findRoute(v->path[firstHop], v->destinationID, currentTime);
+        if (tail.size() < 2) continue; // No way around: wait for the road to reopen
+        v->path.resize(firstHop + 1);
+        v->path.insert(v->path.end(), tail.begin() + 1, tail.end());
+    }
+}
+
+void TrafficNetwork::recordTrip(Vehicle* v) {
+    v->arrivalTime = currentTime;
+    double tripTime = currentTime - v->spawnTime;
+
+    // Free-flow time: path length driven at cruise speed with no queues or red lights
+    double pathLength = v->path.empty() ? 0.0 : pathDistance(v, v->path.size() - 1);
+    double delay = tripTime - pathLength / VEHICLE_SPEED;
+
+    stats.tripsCompleted++;
+    stats.totalTripTime += tripTime;
+    stats.totalDelay += (delay > 0.0) ? delay : 0.0;
+    if (v->isEmergency) {
+        stats.emergencyTripsCompleted++;
+        stats.totalEmergencyTripTime += tripTime;
+    }
+}
+
+void TrafficNetwork::recordUnfinishedTrips() {
+    for (auto& pair : vehicles) {
+        Vehicle* v = pair.second;
+        if (v->arrivalTime >= 0 || v->spawnTime > currentTime) continue; // Arrived or not due yet
+
+        double elapsed = currentTime - v->spawnTime;
+        double covered = pathDistance(v, v->pathIndex) + (v->isMoving ? v->currentPosition : 0.0);
+        double delay = elapsed - covered / VEHICLE_SPEED;
+
+        stats.tripsUnfinished++;
+        stats.totalUnfinishedDelay += (delay > 0.0) ? delay : 0.0;
+        if (v->isEmergency) {
+            stats.emergencyTripsUnfinished++;
+            stats.totalUnfinishedEmergencyTime += elapsed;
+        }
+    }
+}
+
+// Length of the first `hops` roads of the vehicle's path
+double TrafficNetwork::pathDistance(const Vehicle* v, size_t hops) {
+    double distance = 0.0;
+    for (size_t i = 0; i < hops && i + 1 < v->path.size(); ++i) {
+        if (intersections.find(v->path[i]) == intersections.end()) continue;
+        for (Road* r : intersections[v->path[i]]->outgoingRoads) {
+            if (r->destinationID == v->path[i + 1]) {
+                distance += r->baseDistance;
+                break;
+            }
+        }
+    }
+    return distance;
+}
+
+void TrafficNetwork::printStatistics() {
+    std::cout << "--- SIMULATION STATISTICS ---" << std::endl;
+    std::cout << "Trips Completed: " << stats.tripsCompleted << std::endl;
+    std::cout << "Average Trip Time: " << stats.getAverageTripTime() << "s" << std::endl;
+    std::cout << "Average Delay: " << stats.getAverageDelay() << "s" << std::endl;
+    std::cout << "Trips Unfinished: " << stats.tripsUnfinished << std::endl;
+    std::cout << "Emergency Trips Completed: " << stats.emergencyTripsCompleted << std::endl;
+    std::cout << "Emergency Trips Unfinished: " << stats.emergencyTripsUnfinished << std::endl;
+    std::cout << "Average Emergency Clearance Time: " << stats.getAverageEmergencyClearanceTime() << "s" << std::endl;
+    if (predictiveRouting) {
+        std::cout << "Route Cache Hits: " << routeCache.getHits() << " / " << (routeCache.getHits() + routeCache.getMisses()) << std::endl;
+    }
 }
@@ -6,10 +6,17 @@
 #include <vector>
 #include <iostream>
 #include <functional>
+#include <random>
+#include <string>
 #include "Intersection.h"
 #include "Vehicle.h"
 #include "Event.h"
 #include "Road.h"
+#include "SignalPlan.h"
+#include "SimulationStats.h"
+#include "StateWriter.h"
+#include "RouteCache.h"
+#include "MPSCQueue.h"
 
 class TrafficNetwork {
 private:
@@ -19,9 +26,36 @@ private:
     std::priority_queue<Event, std::vector<Event>, std::greater<Event>> eventQueue;
     
     double currentTime;
+    double lastPrint; // Time of the last state snapshot
+    double outputInterval; // Simulated seconds between snapshots
+    bool dropOutputFrames; // Drop snapshots instead of waiting when the output falls behind
+
+    SignalPlan signalPlan; // Adaptive light timing parameters
+    SimulationStats stats;
+    bool headless; // Suppress all console output and skip snapshot capture
+    StateWriter* stateWriter; // Background output stage, only set while runSimulation is active
+    std::mt19937 rng; // Per-network RNG so independent networks can run in parallel
+
+    bool predictiveRouting; // Route on learned travel-time profiles instead of current weights (off by default)
+    RouteCache routeCache;
+
+    MPSCQueue<Event> ingestQueue; // Events injected from other threads
+    size_t ingestBatchSize; // Max injected events moved into eventQueue per tick
+    int nextVehicleID; // IDs for vehicles spawned by injected demand
+
+    void recordTrip(Vehicle* v);
+    void recordUnfinishedTrips();
+    double pathDistance(const Vehicle* v, size_t hops);
+    void drainIngestQueue();
+    Road* findRoad(int id);
+    void enterRoad(Vehicle* v, Road* r);
+    void leaveRoad(Vehicle* v, Road* r);
+    void rerouteVehicles();
+    std::vector<int> dijkstra(int startNode, int destNode, double startLabel,
+                              const std::function<double(const Road*, double)>& edgeCost);
 
 public:
-    TrafficNetwork();
+    TrafficNetwork(unsigned int seed = 5489u);
     ~TrafficNetwork();
 
     // Graph Construction
@@ -32,6 +66,7 @@ public:
     // Visualization Support
     void printStaticGraph();
     void printNetworkState();
+    void captureNetworkState(FrameSnapshot& frame);
 
     // Simulation Control
     void scheduleEvent(double time, EventType type, int entityID, int secondaryID = -1);
@@ -39,11 +74,37 @@ public:
     void processEvent(const Event& event);
     void resetVehicle(Vehicle* v);
 
+    // Thread-safe, non-blocking: may be called from any thread while the simulation runs.
+    // Events with a timestamp in the past are processed on the next tick.
+    // Returns false if the bounded ingestion queue is full; the caller decides
+    // whether to retry or drop, so the simulation thread is never held up.
+    bool injectEvent(const Event& event) { return ingestQueue.tryPush(event); }
+
+    // Configuration
+    void setSignalPlan(const SignalPlan& plan) { signalPlan = plan; }
+    const SignalPlan& getSignalPlan() const { return signalPlan; }
+    void setHeadless(bool enabled) { headless = enabled; }
+    void setOutputInterval(double seconds) { outputInterval = seconds; }
+    void setDropOutputFrames(bool enabled) { dropOutputFrames = enabled; }
+    void setPredictiveRouting(bool enabled) { predictiveRouting = enabled; routeCache.clear(); }
+    void setIngestBatchSize(size_t maxEvents) { ingestBatchSize = maxEvents; }
+
+    // Statistics
+    const SimulationStats& getStatistics() const { return stats; }
+    void printStatistics();
+
     // Vehicle Management
     void spawnVehicle(int id, int startNode, int destNode, bool isEmergency, double spawnTime);
     
     // Algorithms
     std::vector<int> calculateShortestPath(int startNode, int destNode); // Dijkstra
+    std::vector<int> calculateTimeDependentPath(int startNode, int destNode, double departureTime);
+    std::vector<int> findRoute(int startNode, int destNode, double departureTime); // Cached, picks algorithm
+    const RouteCache& getRouteCache() const { return routeCache; }
+
+    // Travel-time profile persistence
+    bool saveTravelTimeProfiles(const std::string& filename);
+    bool loadTravelTimeProfiles(const std::string& filename);
 };
 
 #endif // TRAFFICNETWORK_H
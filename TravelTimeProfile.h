@@ -0,0 +1,59 @@
+#ifndef TRAVELTIMEPROFILE_H
+#define TRAVELTIMEPROFILE_H
+
+#include <cmath>
+#include <vector>
+
+// Piecewise-linear travel time of a road as a function of entry time.
+// Breakpoints are spaced every `interval` seconds; each one holds a running
+// average of the traversal times observed for vehicles entering near it.
+class TravelTimeProfile {
+public:
+    double interval;
+    std::vector<float> times;           // Learned travel time at each breakpoint
+    std::vector<unsigned short> counts; // Observations per breakpoint (0 = unknown)
+
+    TravelTimeProfile(double interval = 30.0) : interval(interval) {}
+
+    bool hasData() const {
+        return !times.empty();
+    }
+
+    void addObservation(double entryTime, double travelTime) {
+        if (entryTime < 0.0 || interval <= 0.0) return;
+        size_t idx = (size_t)std::lround(entryTime / interval);
+        if (idx >= times.size()) {
+            times.resize(idx + 1, 0.0f);
+            counts.resize(idx + 1, 0);
+        }
+
+        // Running mean for the first samples, then a moving average so the
+        // profile keeps tracking conditions that change from run to run
+        double alpha = 1.0 / (counts[idx] + 1);
+        if (alpha < 0.2) alpha = 0.2;
+        times[idx] += (float)((travelTime - times[idx]) * alpha);
+        if (counts[idx] < 65535) counts[idx]++;
+    }
+
+    // Predicted travel time for a vehicle entering at `time`.
+    // Breakpoints without observations use `fallback`.
+    double travelTime(double time, double fallback) const {
+        if (interval <= 0.0) return fallback;
+        if (time < 0.0) time = 0.0;
+        double pos = time / interval;
+        size_t i0 = (size_t)pos;
+        double frac = pos - i0;
+
+        double v0 = valueAt(i0, fallback);
+        double v1 = valueAt(i0 + 1, fallback);
+        return v0 + (v1 - v0) * frac;
+    }
+
+private:
+    double valueAt(size_t idx, double fallback) const {
+        if (idx < counts.size() && counts[idx] > 0) return times[idx];
+        return fallback;
+    }
+};
+
+#endif // TRAVELTIMEPROFILE_H
@@ -5,6 +5,8 @@
 #include <stack>
 #include <vector>
 
+static const double VEHICLE_SPEED = 10.0; // m/s, uniform cruise speed used by the physics step
+
 class Vehicle {
 public:
     int id;
@@ -17,15 +19,17 @@ public:
     int pathIndex; // Current position in the path
 
     double currentPosition; // Distance from start of current road
+    double roadEntryTime; // When the vehicle entered its current road
     double speed;
     bool isMoving;
     double length;
     double minGap;
+    bool oneShot; // Injected trip: retired on arrival instead of being recycled
 
     Vehicle(int id, int startNode, int endNode, bool emergency, double spawnTime)
         : id(id), currentIntersectionID(startNode), destinationID(endNode), 
           isEmergency(emergency), spawnTime(spawnTime), arrivalTime(-1.0), pathIndex(0),
-          currentPosition(0.0), speed(0.0), isMoving(false), length(4.0), minGap(2.0) {}
+          currentPosition(0.0), roadEntryTime(0.0), speed(0.0), isMoving(false), length(4.0), minGap(2.0), oneShot(false) {}
 
     // Methods to be implemented in .cpp
     void setPath(const std::vector<int>& newPath);
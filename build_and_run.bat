@@ -1,7 +1,7 @@
 @echo off
 set PATH=C:\msys64\mingw64\bin;%PATH%
 echo Building Project...
-C:\msys64\mingw64\bin\g++.exe main.cpp TrafficNetwork.cpp Intersection.cpp Vehicle.cpp -o main.exe
+C:\msys64\mingw64\bin\g++.exe main.cpp TrafficNetwork.cpp Intersection.cpp Vehicle.cpp SignalPlanEvaluator.cpp StateWriter.cpp RouteCache.cpp IncidentFeed.cpp -o main.exe
 if %errorlevel% neq 0 (
     echo Compilation Failed!
     pause
@@ -2,13 +2,64 @@
 #include <vector>
 #include <cstdlib>
 #include <ctime>
+#include <cstring>
+#include <thread>
 #include "TrafficNetwork.h"
+#include "Scenario.h"
+#include "SignalPlanEvaluator.h"
+#include "IncidentFeed.h"
+
+// Search a grid of signal plans on the same scenario and report the best one
+void tuneSignalPlans(const Scenario& scenario) {
+    std::vector<SignalPlan> plans = SignalPlanEvaluator::makeGrid(
+        {1.5, 2.0, 2.5, 3.0},     // seconds per queued car
+        {3.0, 5.0, 8.0},          // min green
+        {20.0, 30.0, 45.0},       // max green
+        {2.0, 2.5, 3.0},          // seconds per car ahead of ambulance
+        {8.0, 10.0, 15.0});       // emergency min green
+
+    SignalPlanEvaluator evaluator(scenario);
+    std::cout << "Evaluating " << plans.size() << " signal plans in parallel..." << std::endl;
+    std::vector<PlanScore> scores = evaluator.evaluate(plans);
+
+    int best = SignalPlanEvaluator::bestPlanIndex(scores);
+    if (best == -1) return;
+
+    const PlanScore& s = scores[best];
+    std::cout << "--- BEST SIGNAL PLAN ---" << std::endl;
+    std::cout << "Seconds Per Queued Car: " << s.plan.secondsPerQueuedCar << std::endl;
+    std::cout << "Green Clamp: " << s.plan.minGreen << "s - " << s.plan.maxGreen << "s" << std::endl;
+    std::cout << "Seconds Per Car Ahead Of Ambulance: " << s.plan.secondsPerCarAheadOfEmergency << std::endl;
+    std::cout << "Emergency Min Green: " << s.plan.emergencyMinGreen << "s" << std::endl;
+    std::cout << "Trips Completed: " << s.stats.tripsCompleted
+              << ", Average Delay: " << s.stats.getAverageDelay() << "s"
+              << ", Average Emergency Clearance Time: " << s.stats.getAverageEmergencyClearanceTime() << "s" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    // Usage: main.exe [--tune] [--headless] [--interval <seconds>] [--drop-frames] [--predictive] [--profiles <file>] [--feed <file>]
+    bool tune = false;
+    bool headless = false;
+    double outputInterval = 0.5;
+    bool dropFrames = false; // Never let slow output stall the simulation, at the cost of frames
+    bool predictive = false; // Route on learned travel-time profiles
+    const char* profileFile = nullptr; // Travel-time profiles loaded before the run and saved after it
+    const char* feedFile = nullptr; // Incidents and demand replayed from another thread during the run
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--tune") == 0) tune = true;
+        else if (std::strcmp(argv[i], "--headless") == 0) headless = true;
+        else if (std::strcmp(argv[i], "--interval") == 0 && i + 1 < argc) outputInterval = std::atof(argv[++i]);
+        else if (std::strcmp(argv[i], "--drop-frames") == 0) dropFrames = true;
+        else if (std::strcmp(argv[i], "--predictive") == 0) predictive = true;
+        else if (std::strcmp(argv[i], "--profiles") == 0 && i + 1 < argc) profileFile = argv[++i];
+        else if (std::strcmp(argv[i], "--feed") == 0 && i + 1 < argc) feedFile = argv[++i];
+    }
 
-int main() {
     std::srand(std::time(0)); // Seed random number generator
     std::cout << "Initializing Big City Traffic Simulation..." << std::endl;
     
-    TrafficNetwork city;
+    Scenario scenario;
+    scenario.seed = std::rand();
     
     // 1. Create a 4x4 Grid Network (16 Intersections)
     int rows = 4;
@@ -18,7 +69,7 @@ int main() {
     for (int r = 0; r < rows; ++r) {
         for (int c = 0; c < cols; ++c) {
             int id = r * cols + c;
-            city.addIntersection(id, c * blockSize + 50, r * blockSize + 50); 
+            scenario.nodes.push_back({id, c * blockSize + 50, r * blockSize + 50}); 
         }
     }
     
@@ -33,21 +84,19 @@ int main() {
             // Connect to Right (East)
             if (c < cols - 1) {
                 int right = r * cols + (c + 1);
-                city.addRoad(roadIDCounter++, curr, right, blockSize, speedLimit);
-                city.addRoad(roadIDCounter++, right, curr, blockSize, speedLimit);
+                scenario.roads.push_back({roadIDCounter++, curr, right, blockSize, speedLimit});
+                scenario.roads.push_back({roadIDCounter++, right, curr, blockSize, speedLimit});
             }
             
             // Connect to Bottom (South)
             if (r < rows - 1) {
                 int bottom = (r + 1) * cols + c;
-                city.addRoad(roadIDCounter++, curr, bottom, blockSize, speedLimit);
-                city.addRoad(roadIDCounter++, bottom, curr, blockSize, speedLimit);
+                scenario.roads.push_back({roadIDCounter++, curr, bottom, blockSize, speedLimit});
+                scenario.roads.push_back({roadIDCounter++, bottom, curr, blockSize, speedLimit});
             }
         }
     }
     
-    city.printStaticGraph();
-    
     // 3. Spawn Vehicles
     int numVehicles = 300;
     std::cout << "Spawning " << numVehicles << " vehicles over 300 seconds..." << std::endl;
@@ -65,24 +114,51 @@ int main() {
         // This creates a realistic flow of ~1 car per second across the whole city.
         double spawnTime = (double)(std::rand() % 300); 
         
-        city.spawnVehicle(i + 1, startNode, destNode, isEmergency, spawnTime);
+        scenario.demand.push_back({i + 1, startNode, destNode, isEmergency, spawnTime});
     }
 
     // TEST: Spawn a GUARANTEED Ambulance (Vehicle 999) late in the simulation
     // Spawning at t=150s ensures there is already traffic on the road to interact with.
     std::cout << "Spawning TEST AMBULANCE (ID 999) at t=150.0s..." << std::endl;
-    city.spawnVehicle(999, 0, 15, true, 150.0);
+    scenario.demand.push_back({999, 0, 15, true, 150.0});
     
-    // 4. Run Simulation
     // Increased duration to 600s to allow late-spawning cars to finish.
-    double duration = 600.0; 
-    std::cout << "Starting Simulation (Duration: " << duration << " seconds)..." << std::endl;
-    city.runSimulation(duration);
+    scenario.duration = 600.0; 
+
+    if (tune) {
+        tuneSignalPlans(scenario);
+        return 0;
+    }
+
+    TrafficNetwork city(scenario.seed);
+    city.setHeadless(headless);
+    city.setOutputInterval(outputInterval);
+    city.setDropOutputFrames(dropFrames);
+    city.setPredictiveRouting(predictive);
+    scenario.buildGraph(city);
+    if (profileFile && city.loadTravelTimeProfiles(profileFile)) {
+        std::cout << "Loaded travel-time profiles from " << profileFile << std::endl;
+    }
+    scenario.addDemand(city);
+    if (!headless) city.printStaticGraph();
+    
+    // 4. Run Simulation
+    std::cout << "Starting Simulation (Duration: " << scenario.duration << " seconds)..." << std::endl;
+    std::thread feed;
+    if (feedFile) {
+        feed = std::thread([&city, feedFile]() { replayIncidentFeed(feedFile, city); });
+    }
+    city.runSimulation(scenario.duration);
+    if (feed.joinable()) feed.join();
     
     // PRINT STATS
     city.printStatistics();
+
+    if (profileFile && city.saveTravelTimeProfiles(profileFile)) {
+        std::cout << "Saved travel-time profiles to " << profileFile << std::endl;
+    }
     
     std::cout << "Simulation Complete." << std::endl;
     
     return 0;
-}
\ No newline at end of file
+}
\ No newline at end of file